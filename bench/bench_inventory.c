@@ -0,0 +1,190 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "inventory.h"
+#include "inventory_fixed.h"
+
+/*
+ * ============================================================================
+ * BENCHMARK - Caminho Genérico x Variante Especializada
+ * ============================================================================
+ * Compara sort_items()/find_item_index() com as funções geradas por
+ * DEFINE_FIXED_INVENTORY para mochilas de 10, 32 e 64 itens.
+ *
+ * Cada rodada ordena uma cópia do mesmo conjunto embaralhado, então os dois
+ * caminhos recebem exatamente a mesma entrada. O tempo inclui o memcpy da
+ * cópia, igual para ambos.
+ *
+ * Antes de medir, cada configuração confere que a variante fixa produz o
+ * mesmo resultado que o caminho genérico; divergência aborta o benchmark,
+ * pois ganho de velocidade com resultado errado não significa nada.
+ */
+
+#define BENCH_ROUNDS 200000
+#define BENCH_MAX_N 64
+
+// Instâncias por capacidade e critério
+DEFINE_FIXED_INVENTORY(fixed10_name, 10, NAME)
+DEFINE_FIXED_INVENTORY(fixed10_type, 10, TYPE)
+DEFINE_FIXED_INVENTORY(fixed10_prio, 10, PRIORITY)
+DEFINE_FIXED_INVENTORY(fixed32_name, 32, NAME)
+DEFINE_FIXED_INVENTORY(fixed32_type, 32, TYPE)
+DEFINE_FIXED_INVENTORY(fixed32_prio, 32, PRIORITY)
+DEFINE_FIXED_INVENTORY(fixed64_name, 64, NAME)
+DEFINE_FIXED_INVENTORY(fixed64_type, 64, TYPE)
+DEFINE_FIXED_INVENTORY(fixed64_prio, 64, PRIORITY)
+
+typedef void (*FixedSortFn)(Item *inventory, int used);
+typedef int (*FixedFindFn)(const Item *inventory, int used, const char *name);
+
+// Resultado acumulado impede que o compilador descarte o trabalho medido
+static volatile long sink;
+
+static void fill_items(Item *items, int n) {
+    // Tipos e nomes com prefixos de 7 bytes repetidos, mas sufixos fora da
+    // ordem de posição, para exercitar o ajuste de empates da variante fixa
+    static const char *types[] = { "Cura", "Arma", "Municao Pesada", "Municao Leve" };
+
+    // Zera bytes após o '\0' e de alinhamento, para que memcmp compare só dados
+    memset(items, 0, sizeof(Item) * n);
+    for (int i = 0; i < n; i++) {
+        snprintf(items[i].name, ITEM_NAME_LEN, "Item %c%c%02d",
+                 'A' + rand() % 4, 'a' + rand() % 4, rand() % 100);
+        strcpy(items[i].type, types[rand() % 4]);
+        items[i].quantity = rand() % 100;
+        items[i].priority = 1 + rand() % MAX_PRIORITY;
+    }
+}
+
+/**
+ * Acima da capacidade as funções fixas recorrem ao caminho genérico:
+ * instância de 10 posições recebendo n itens deve dar o mesmo resultado
+ */
+static void check_over_capacity(const Item *base, int n) {
+    Item expected[BENCH_MAX_N];
+    Item work[BENCH_MAX_N];
+
+    memcpy(expected, base, sizeof(Item) * n);
+    sort_items(expected, n, SORT_NAME);
+    memcpy(work, base, sizeof(Item) * n);
+    fixed10_name_sort(work, n);
+    if (memcmp(expected, work, sizeof(Item) * n) != 0) {
+        fprintf(stderr, "[ERRO] N=%d acima da capacidade 10: sort difere\n", n);
+        exit(1);
+    }
+    if (fixed10_name_find(base, n, base[n - 1].name) != find_item_index(base, n, base[n - 1].name)) {
+        fprintf(stderr, "[ERRO] N=%d acima da capacidade 10: find difere\n", n);
+        exit(1);
+    }
+}
+
+static double elapsed_ns(clock_t start, int ops) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / ops;
+}
+
+static void bench_sort(const Item *base, int n, SortCriterion crit,
+                       const char *label, FixedSortFn fixed_sort) {
+    Item expected[BENCH_MAX_N];
+    Item work[BENCH_MAX_N];
+    clock_t start;
+
+    memcpy(expected, base, sizeof(Item) * n);
+    sort_items(expected, n, crit);
+    memcpy(work, base, sizeof(Item) * n);
+    fixed_sort(work, n);
+    if (memcmp(expected, work, sizeof(Item) * n) != 0) {
+        fprintf(stderr, "[ERRO] N=%d sort %s: variante fixa difere de sort_items()\n",
+                n, label);
+        exit(1);
+    }
+
+    start = clock();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        memcpy(work, base, sizeof(Item) * n);
+        sort_items(work, n, crit);
+        sink += work[r % n].quantity;
+    }
+    double generic = elapsed_ns(start, BENCH_ROUNDS);
+
+    start = clock();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        memcpy(work, base, sizeof(Item) * n);
+        fixed_sort(work, n);
+        sink += work[r % n].quantity;
+    }
+    double fixed = elapsed_ns(start, BENCH_ROUNDS);
+
+    printf("N=%-3d | sort %-10s | %10.1f | %10.1f | %5.2fx\n",
+           n, label, generic, fixed, generic / fixed);
+}
+
+static void bench_find(const Item *base, int n, FixedFindFn fixed_find) {
+    char queries[BENCH_MAX_N][ITEM_NAME_LEN];
+    clock_t start;
+
+    // Consulta em caixa diferente para exercitar a comparação case-insensitive
+    for (int i = 0; i < n; i++) {
+        strcpy(queries[i], base[i].name);
+        queries[i][0] = 'i';
+    }
+
+    for (int i = 0; i < n; i++) {
+        if (find_item_index(base, n, queries[i]) != fixed_find(base, n, queries[i])) {
+            fprintf(stderr, "[ERRO] N=%d find '%s': variante fixa difere de find_item_index()\n",
+                    n, queries[i]);
+            exit(1);
+        }
+    }
+    if (fixed_find(base, n, "Inexistente") != -1) {
+        fprintf(stderr, "[ERRO] N=%d find: variante fixa encontrou item inexistente\n", n);
+        exit(1);
+    }
+
+    start = clock();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        sink += find_item_index(base, n, queries[r % n]);
+    }
+    double generic = elapsed_ns(start, BENCH_ROUNDS);
+
+    start = clock();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        sink += fixed_find(base, n, queries[r % n]);
+    }
+    double fixed = elapsed_ns(start, BENCH_ROUNDS);
+
+    printf("N=%-3d | find %-10s | %10.1f | %10.1f | %5.2fx\n",
+           n, "nome", generic, fixed, generic / fixed);
+}
+
+int main() {
+    Item base[BENCH_MAX_N];
+    srand(42);
+
+    // Larguras compensam os bytes extras dos acentos em UTF-8
+    printf("%-5s | %-17s | %11s | %10s | %s\n",
+           "N", "Operação", "Genér.(ns)", "Fixo (ns)", "Ganho");
+    printf("----------------------------------------------------------\n");
+
+    fill_items(base, 10);
+    bench_sort(base, 10, SORT_NAME, "nome", fixed10_name_sort);
+    bench_sort(base, 10, SORT_TYPE, "tipo", fixed10_type_sort);
+    bench_sort(base, 10, SORT_PRIORITY, "prioridade", fixed10_prio_sort);
+    bench_find(base, 10, fixed10_name_find);
+
+    fill_items(base, 32);
+    check_over_capacity(base, 32);
+    bench_sort(base, 32, SORT_NAME, "nome", fixed32_name_sort);
+    bench_sort(base, 32, SORT_TYPE, "tipo", fixed32_type_sort);
+    bench_sort(base, 32, SORT_PRIORITY, "prioridade", fixed32_prio_sort);
+    bench_find(base, 32, fixed32_name_find);
+
+    fill_items(base, 64);
+    bench_sort(base, 64, SORT_NAME, "nome", fixed64_name_sort);
+    bench_sort(base, 64, SORT_TYPE, "tipo", fixed64_type_sort);
+    bench_sort(base, 64, SORT_PRIORITY, "prioridade", fixed64_prio_sort);
+    bench_find(base, 64, fixed64_name_find);
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+#ifndef AGGREGATE_H
+#define AGGREGATE_H
+
+#include "inventory.h"
+
+/*
+ * ============================================================================
+ * MÓDULO DE AGREGAÇÃO - Totais de Quantidade por Grupo
+ * ============================================================================
+ * Mantém soma, contagem, mínimo e máximo de quantity agrupados por tipo e
+ * por prioridade. Os agregados são atualizados a cada adição/remoção, de
+ * modo que as consultas custam O(grupos) em vez de O(itens).
+ */
+
+/**
+ * Agregados de quantidade de um grupo
+ * min/max só têm significado quando count > 0
+ */
+typedef struct {
+    int count;
+    long long sum;  // long long: soma de várias quantidades pode exceder int
+    int min;
+    int max;
+} QuantityStats;
+
+/**
+ * Grupo por tipo - comparação case-insensitive, como nas buscas por nome
+ * type guarda a grafia do primeiro item cadastrado no grupo
+ */
+typedef struct {
+    char type[ITEM_TYPE_LEN];
+    char key[ITEM_TYPE_LEN];  // type normalizado em maiúsculas
+    QuantityStats stats;
+} TypeGroup;
+
+/**
+ * Estado completo da agregação
+ * Cada item tem um único tipo, então INVENTORY_SIZE grupos bastam
+ */
+typedef struct {
+    QuantityStats total;
+    QuantityStats by_priority[MAX_PRIORITY + 1];  // índice 0 = sem prioridade
+    TypeGroup by_type[INVENTORY_SIZE];
+    int type_count;
+} InventoryStats;
+
+/**
+ * Recalcula todos os agregados em uma única varredura - O(n)
+ * Também serve para inicializar a estrutura (used = 0)
+ */
+void stats_rebuild(InventoryStats *stats, const Item *inventory, int used);
+
+/**
+ * Atualização incremental após cadastro de item - O(grupos)
+ */
+void stats_add_item(InventoryStats *stats, const Item *item);
+
+/**
+ * Atualização incremental após remoção de item
+ * O(grupos), exceto quando o item removido era o mínimo/máximo de um
+ * grupo: nesse caso só esse grupo é revarrido no inventário atual
+ *
+ * @param inventory Inventário já sem o item removido
+ * @param removed Cópia do item que saiu
+ */
+void stats_remove_item(InventoryStats *stats, const Item *inventory, int used,
+                       const Item *removed);
+
+/**
+ * Consulta agregados de um tipo (case-insensitive) - O(grupos)
+ * @return Agregados do tipo ou NULL se não houver itens desse tipo
+ */
+const QuantityStats *stats_by_type(const InventoryStats *stats, const char *type);
+
+/**
+ * Consulta agregados de um nível de prioridade - O(1)
+ * @return Agregados do nível ou NULL se priority estiver fora de 0..MAX_PRIORITY
+ */
+const QuantityStats *stats_by_priority(const InventoryStats *stats, int priority);
+
+/**
+ * Exibe resumo agrupado por tipo e, se houver, por prioridade
+ */
+void print_stats(const InventoryStats *stats);
+
+#endif // AGGREGATE_H
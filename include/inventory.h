@@ -5,6 +5,7 @@
 #define INVENTORY_SIZE 10
 #define ITEM_NAME_LEN 20
 #define ITEM_TYPE_LEN 15
+#define MAX_PRIORITY 5
 
 /*
  * ============================================================================
@@ -54,15 +55,28 @@ void list_items(const Item *inventory, int used);
 
 /**
  * Remove item por nome (busca case-insensitive)
+ * @param removed Recebe cópia do item removido (pode ser NULL)
  * @return 1 se removido com sucesso, 0 se não encontrado
  */
-int remove_item_by_name(Item *inventory, int *used);
+int remove_item_by_name(Item *inventory, int *used, Item *removed);
+
+/**
+ * Localiza item por nome sem imprimir (case-insensitive) - O(n)
+ * @return Índice do item ou -1 se não encontrado
+ */
+int find_item_index(const Item *inventory, int used, const char *name);
 
 /**
  * Busca sequencial case-insensitive - O(n)
  */
 void search_item_by_name(const Item *inventory, int used, const char *name);
 
+/**
+ * Insertion Sort sem saída no terminal - O(n²)
+ * @return Número de comparações realizadas
+ */
+int sort_items(Item *inventory, int used, SortCriterion crit);
+
 /**
  * Ordena inventário usando Insertion Sort - O(n²)
  */
@@ -75,4 +89,20 @@ void sort_inventory(Item *inventory, int used, SortCriterion crit);
  */
 int binary_search_by_name(const Item *inventory, int used, const char *name);
 
+/**
+ * Consulta os k primeiros itens na ordem do critério (heap limitado) - O(n log k)
+ * Não altera o inventário: a ordenação atual continua válida
+ * @param out_indices Recebe até k índices do inventário, em ordem crescente
+ * @return Quantidade de índices escritos (min(k, used))
+ */
+int top_k_items(const Item *inventory, int used, SortCriterion crit, int k, int *out_indices);
+
+/**
+ * Consulta o item que ocuparia a posição n após ordenar (introselect) - O(n)
+ * Não altera o inventário: a ordenação atual continua válida
+ * @param n Posição desejada, começando em 0
+ * @return Índice do item no inventário ou -1 se n estiver fora do intervalo
+ */
+int nth_item_index(const Item *inventory, int used, SortCriterion crit, int n);
+
 #endif // INVENTORY_H
@@ -0,0 +1,188 @@
+#ifndef INVENTORY_FIXED_H
+#define INVENTORY_FIXED_H
+
+#include <ctype.h>
+#include <stdint.h>
+#include <string.h>
+#include "inventory.h"
+#include "sorting_networks.h"
+
+/*
+ * ============================================================================
+ * INVENTÁRIO ESPECIALIZADO EM TEMPO DE COMPILAÇÃO
+ * ============================================================================
+ * DEFINE_FIXED_INVENTORY gera, para uma capacidade e um critério fixos,
+ * funções static inline que operam sobre o mesmo Item[] / used da API
+ * genérica. Como capacidade e critério são constantes:
+ *
+ * - a ordenação é a rede de ordenação de CAPACITY entradas, expandida como
+ *   código linear (ver sorting_networks.h); a rede troca chaves inteiras de
+ *   64 bits com min/max sem desvio, não structs de 36 bytes;
+ * - a chave e a comparação do critério são expandidas pela macro, sem o
+ *   if/else em tempo de execução de compare_items();
+ * - a busca por nome normaliza a consulta uma única vez e testa as CAPACITY
+ *   posições em código desenrolado (UNROLL_<n> de sorting_networks.h), sem
+ *   as cópias strncpy da versão genérica; só a comparação de caracteres
+ *   dentro de cada posição continua sendo um laço.
+ *
+ * Uso:
+ *     DEFINE_FIXED_INVENTORY(backpack, INVENTORY_SIZE, NAME)
+ *     backpack_sort(inventory, used);
+ *     backpack_find(inventory, used, "kit");   // índice ou -1
+ *
+ * Com used > CAPACITY as funções recorrem a sort_items()/find_item_index(),
+ * então o resultado continua correto, só sem a especialização.
+ *
+ * O critério é o sufixo de SortCriterion: NAME, TYPE ou PRIORITY.
+ * CAPACITY precisa ser um literal (ou macro que expanda para um) com rede
+ * disponível em sorting_networks.h: 1 a 16, 32 ou 64.
+ */
+
+/*
+ * Formato da chave: [ valor do critério (56 bits) | posição original (8 bits) ]
+ * A posição no byte baixo desempata iguais, reproduzindo a estabilidade do
+ * Insertion Sort, e diz de onde copiar o item ao final.
+ */
+#define FIXED_INV_INDEX_BITS 8
+#define FIXED_INV_INDEX_MASK 0xFFu
+#define FIXED_INV_PREFIX_LEN 7
+
+/**
+ * Chave de texto: primeiros 7 bytes em big-endian (mesma ordem de strcmp)
+ * Strings que empatam no prefixo são resolvidas depois, com strcmp
+ */
+static inline uint64_t fixed_inv_text_key(const char *str, int index) {
+    uint64_t key = 0;
+    int i = 0;
+    for (; i < FIXED_INV_PREFIX_LEN && str[i]; i++) key = (key << 8) | (unsigned char)str[i];
+    for (; i < FIXED_INV_PREFIX_LEN; i++) key <<= 8;
+    return (key << FIXED_INV_INDEX_BITS) | (unsigned)index;
+}
+
+/**
+ * Chave numérica exata: o XOR no bit de sinal preserva a ordem de int
+ */
+static inline uint64_t fixed_inv_int_key(int value, int index) {
+    uint64_t biased = (uint32_t)value ^ 0x80000000u;
+    return (biased << FIXED_INV_INDEX_BITS) | (unsigned)index;
+}
+
+// Chave e desempate completo por critério (token colado em DEFINE_FIXED_INVENTORY)
+#define FIXED_INV_KEY_NAME(item, i)      fixed_inv_text_key((item)->name, (i))
+#define FIXED_INV_KEY_TYPE(item, i)      fixed_inv_text_key((item)->type, (i))
+#define FIXED_INV_KEY_PRIORITY(item, i)  fixed_inv_int_key((item)->priority, (i))
+#define FIXED_INV_CMP_NAME(a, b)         strcmp((a)->name, (b)->name)
+#define FIXED_INV_CMP_TYPE(a, b)         strcmp((a)->type, (b)->type)
+#define FIXED_INV_CMP_PRIORITY(a, b)     ((void)(a), (void)(b), 0)
+#define FIXED_INV_EXACT_NAME             0  // prefixo pode empatar
+#define FIXED_INV_EXACT_TYPE             0
+#define FIXED_INV_EXACT_PRIORITY         1  // chave já decide a ordem
+
+// Compara-e-troca sem desvio sobre o vetor local keys de PREFIX_sort
+#define FIXED_INV_CE(x, y) {                                                    \
+    uint64_t lo_ = keys[x], hi_ = keys[y];                                      \
+    keys[x] = lo_ < hi_ ? lo_ : hi_;                                            \
+    keys[y] = lo_ < hi_ ? hi_ : lo_;                                            \
+}
+
+// Sonda uma posição de PREFIX_find; usa used, inventory e query locais
+#define FIXED_INV_PROBE(i)                                                      \
+    if ((i) >= used) return -1;                                                 \
+    if (fixed_inv_upper_equals(inventory[i].name, query)) return (i);
+
+// Indireção para que CAPACITY seja expandido antes da colagem de tokens
+#define FIXED_INV_NETWORK(n)  FIXED_INV_NETWORK_(n)
+#define FIXED_INV_NETWORK_(n) SORTING_NETWORK_##n(FIXED_INV_CE)
+#define FIXED_INV_UNROLL(n)   FIXED_INV_UNROLL_(n)
+#define FIXED_INV_UNROLL_(n)  UNROLL_##n(FIXED_INV_PROBE)
+
+/**
+ * Normaliza a consulta para maiúsculas, truncada como em find_item_index()
+ */
+static inline void fixed_inv_upper_copy(char *dst, const char *src) {
+    int i = 0;
+    for (; i < ITEM_NAME_LEN - 1 && src[i]; i++) dst[i] = toupper((unsigned char)src[i]);
+    dst[i] = '\0';
+}
+
+/**
+ * Compara nome com consulta já em maiúsculas, sem copiar o nome
+ * Equivalente a comparar as versões em maiúsculas, como find_item_index()
+ */
+static inline int fixed_inv_upper_equals(const char *name, const char *upper) {
+    for (int i = 0; i < ITEM_NAME_LEN - 1; i++) {
+        if (toupper((unsigned char)name[i]) != (unsigned char)upper[i]) return 0;
+        if (name[i] == '\0') return 1;
+    }
+    return 1;
+}
+
+/**
+ * Gera PREFIX_add, PREFIX_find e PREFIX_sort para CAPACITY itens
+ * ordenados por CRIT (NAME, TYPE ou PRIORITY)
+ */
+#define DEFINE_FIXED_INVENTORY(PREFIX, CAPACITY, CRIT)                          \
+                                                                                \
+/* Adiciona por cópia de struct - @return 1 se coube, 0 se cheio */             \
+static inline int PREFIX##_add(Item *inventory, int *used, const Item *item) {  \
+    if (*used >= (CAPACITY)) return 0;                                          \
+    inventory[(*used)++] = *item;                                               \
+    return 1;                                                                   \
+}                                                                               \
+                                                                                \
+/* Busca case-insensitive desenrolada - @return índice ou -1 */               \
+static inline int PREFIX##_find(const Item *inventory, int used,                \
+                                const char *name) {                             \
+    if (used > (CAPACITY)) return find_item_index(inventory, used, name);       \
+                                                                                \
+    char query[ITEM_NAME_LEN];                                                  \
+    fixed_inv_upper_copy(query, name);                                          \
+    FIXED_INV_UNROLL(CAPACITY)                                                  \
+    return -1;                                                                  \
+}                                                                               \
+                                                                                \
+/* Ordena por CRIT: rede sobre chaves, ajuste de empates, cópia única */        \
+static inline void PREFIX##_sort(Item *inventory, int used) {                   \
+    /* Acima da capacidade a rede não cobre tudo: caminho genérico */          \
+    if (used > (CAPACITY)) {                                                    \
+        sort_items(inventory, used, SORT_##CRIT);                               \
+        return;                                                                 \
+    }                                                                           \
+                                                                                \
+    uint64_t keys[CAPACITY];                                                    \
+    for (int i = 0; i < (CAPACITY); i++) {                                      \
+        /* Posições vagas recebem a maior chave e ficam no fim */              \
+        keys[i] = (i < used) ? FIXED_INV_KEY_##CRIT(&inventory[i], i)           \
+                             : UINT64_MAX;                                      \
+    }                                                                           \
+                                                                                \
+    FIXED_INV_NETWORK(CAPACITY)                                                 \
+                                                                                \
+    /* Prefixos empatados formam blocos contíguos: Insertion Sort em cada um */\
+    if (!FIXED_INV_EXACT_##CRIT) {                                              \
+        for (int i = 1; i < used; i++) {                                        \
+            uint64_t key = keys[i];                                             \
+            /* Prefixo terminado em '\0': o texto inteiro está na chave */     \
+            if (((key >> FIXED_INV_INDEX_BITS) & 0xFFu) == 0) continue;         \
+            const Item *item = &inventory[key & FIXED_INV_INDEX_MASK];          \
+            int j = i - 1;                                                      \
+            while (j >= 0 && (keys[j] >> FIXED_INV_INDEX_BITS) ==               \
+                             (key >> FIXED_INV_INDEX_BITS)) {                   \
+                const Item *prev = &inventory[keys[j] & FIXED_INV_INDEX_MASK];  \
+                int cmp = FIXED_INV_CMP_##CRIT(prev, item);                     \
+                if (cmp < 0 || (cmp == 0 && keys[j] < key)) break;              \
+                keys[j + 1] = keys[j];                                          \
+                j--;                                                            \
+            }                                                                   \
+            keys[j + 1] = key;                                                  \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    Item sorted[CAPACITY];                                                      \
+    for (int i = 0; i < used; i++) {                                            \
+        sorted[i] = inventory[keys[i] & FIXED_INV_INDEX_MASK];                  \
+    }                                                                           \
+    memcpy(inventory, sorted, sizeof(Item) * used);                             \
+}
+
+#endif // INVENTORY_FIXED_H
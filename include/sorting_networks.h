@@ -0,0 +1,353 @@
+#ifndef SORTING_NETWORKS_H
+#define SORTING_NETWORKS_H
+
+/*
+ * ============================================================================
+ * REDES DE ORDENAÇÃO - Sequências Fixas de Compara-e-Troca
+ * ============================================================================
+ * SORTING_NETWORK_<n>(CE) expande para a sequência de CE(i, j) da rede de
+ * Batcher (odd-even mergesort) com n entradas. Cada CE deve deixar o menor
+ * valor na posição i e o maior na j. Por ser código linear, sem laços nem
+ * desvios dependentes dos dados, o compilador gera tudo desenrolado.
+ *
+ * UNROLL_<n>(STEP) expande para STEP(0) STEP(1) ... STEP(n-1): laço de n
+ * iterações escrito por extenso, para buscas de capacidade fixa.
+ *
+ * ARQUIVO GERADO por tools/gen_sorting_networks.c - não editar à mão.
+ * Para regenerar (ou incluir novo tamanho em NETWORK_SIZES):
+ *
+ *     gcc -O2 -Wall -Wextra -std=c99 tools/gen_sorting_networks.c -o build/gen_networks
+ *     ./build/gen_networks > build/sorting_networks.h \
+ *         && mv build/sorting_networks.h include/sorting_networks.h
+ *
+ * O gerador verifica cada rede pelo princípio 0-1 (exaustivo até 16
+ * entradas, amostral acima) antes de emitir o header.
+ *
+ * Redes disponíveis (entradas): 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 32, 64.
+ */
+
+// 1 entrada, nenhum comparador
+#define SORTING_NETWORK_1(CE)
+
+// 2 entradas, 1 comparador
+#define SORTING_NETWORK_2(CE) \
+    CE(0, 1)
+
+// 3 entradas, 3 comparadores
+#define SORTING_NETWORK_3(CE) \
+    CE(0, 1) CE(0, 2) CE(1, 2)
+
+// 4 entradas, 5 comparadores
+#define SORTING_NETWORK_4(CE) \
+    CE(0, 1) CE(2, 3) CE(0, 2) CE(1, 3) CE(1, 2)
+
+// 5 entradas, 9 comparadores
+#define SORTING_NETWORK_5(CE) \
+    CE(0, 1) CE(2, 3) CE(0, 2) CE(1, 3) CE(1, 2) CE(0, 4) CE(2, 4) CE(1, 2) \
+    CE(3, 4)
+
+// 6 entradas, 12 comparadores
+#define SORTING_NETWORK_6(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(0, 2) CE(1, 3) CE(1, 2) CE(0, 4) CE(1, 5) \
+    CE(2, 4) CE(3, 5) CE(1, 2) CE(3, 4)
+
+// 7 entradas, 16 comparadores
+#define SORTING_NETWORK_7(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(0, 2) CE(1, 3) CE(4, 6) CE(1, 2) CE(5, 6) \
+    CE(0, 4) CE(1, 5) CE(2, 6) CE(2, 4) CE(3, 5) CE(1, 2) CE(3, 4) CE(5, 6)
+
+// 8 entradas, 19 comparadores
+#define SORTING_NETWORK_8(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(6, 7) CE(0, 2) CE(1, 3) CE(4, 6) CE(5, 7) \
+    CE(1, 2) CE(5, 6) CE(0, 4) CE(1, 5) CE(2, 6) CE(3, 7) CE(2, 4) CE(3, 5) \
+    CE(1, 2) CE(3, 4) CE(5, 6)
+
+// 9 entradas, 28 comparadores
+#define SORTING_NETWORK_9(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(6, 7) CE(0, 2) CE(1, 3) CE(4, 6) CE(5, 7) \
+    CE(1, 2) CE(5, 6) CE(0, 4) CE(1, 5) CE(2, 6) CE(3, 7) CE(2, 4) CE(3, 5) \
+    CE(1, 2) CE(3, 4) CE(5, 6) CE(0, 8) CE(4, 8) CE(2, 4) CE(3, 5) CE(6, 8) \
+    CE(1, 2) CE(3, 4) CE(5, 6) CE(7, 8)
+
+// 10 entradas, 32 comparadores
+#define SORTING_NETWORK_10(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(6, 7) CE(8, 9) CE(0, 2) CE(1, 3) CE(4, 6) \
+    CE(5, 7) CE(1, 2) CE(5, 6) CE(0, 4) CE(1, 5) CE(2, 6) CE(3, 7) CE(2, 4) \
+    CE(3, 5) CE(1, 2) CE(3, 4) CE(5, 6) CE(0, 8) CE(1, 9) CE(4, 8) CE(5, 9) \
+    CE(2, 4) CE(3, 5) CE(6, 8) CE(7, 9) CE(1, 2) CE(3, 4) CE(5, 6) CE(7, 8)
+
+// 11 entradas, 38 comparadores
+#define SORTING_NETWORK_11(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(6, 7) CE(8, 9) CE(0, 2) CE(1, 3) CE(4, 6) \
+    CE(5, 7) CE(8, 10) CE(1, 2) CE(5, 6) CE(9, 10) CE(0, 4) CE(1, 5) \
+    CE(2, 6) CE(3, 7) CE(2, 4) CE(3, 5) CE(1, 2) CE(3, 4) CE(5, 6) CE(9, 10) \
+    CE(0, 8) CE(1, 9) CE(2, 10) CE(4, 8) CE(5, 9) CE(6, 10) CE(2, 4) \
+    CE(3, 5) CE(6, 8) CE(7, 9) CE(1, 2) CE(3, 4) CE(5, 6) CE(7, 8) CE(9, 10)
+
+// 12 entradas, 42 comparadores
+#define SORTING_NETWORK_12(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(6, 7) CE(8, 9) CE(10, 11) CE(0, 2) \
+    CE(1, 3) CE(4, 6) CE(5, 7) CE(8, 10) CE(9, 11) CE(1, 2) CE(5, 6) \
+    CE(9, 10) CE(0, 4) CE(1, 5) CE(2, 6) CE(3, 7) CE(2, 4) CE(3, 5) CE(1, 2) \
+    CE(3, 4) CE(5, 6) CE(9, 10) CE(0, 8) CE(1, 9) CE(2, 10) CE(3, 11) \
+    CE(4, 8) CE(5, 9) CE(6, 10) CE(7, 11) CE(2, 4) CE(3, 5) CE(6, 8) \
+    CE(7, 9) CE(1, 2) CE(3, 4) CE(5, 6) CE(7, 8) CE(9, 10)
+
+// 13 entradas, 48 comparadores
+#define SORTING_NETWORK_13(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(6, 7) CE(8, 9) CE(10, 11) CE(0, 2) \
+    CE(1, 3) CE(4, 6) CE(5, 7) CE(8, 10) CE(9, 11) CE(1, 2) CE(5, 6) \
+    CE(9, 10) CE(0, 4) CE(1, 5) CE(2, 6) CE(3, 7) CE(8, 12) CE(2, 4) \
+    CE(3, 5) CE(10, 12) CE(1, 2) CE(3, 4) CE(5, 6) CE(9, 10) CE(11, 12) \
+    CE(0, 8) CE(1, 9) CE(2, 10) CE(3, 11) CE(4, 12) CE(4, 8) CE(5, 9) \
+    CE(6, 10) CE(7, 11) CE(2, 4) CE(3, 5) CE(6, 8) CE(7, 9) CE(10, 12) \
+    CE(1, 2) CE(3, 4) CE(5, 6) CE(7, 8) CE(9, 10) CE(11, 12)
+
+// 14 entradas, 53 comparadores
+#define SORTING_NETWORK_14(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(6, 7) CE(8, 9) CE(10, 11) CE(12, 13) \
+    CE(0, 2) CE(1, 3) CE(4, 6) CE(5, 7) CE(8, 10) CE(9, 11) CE(1, 2) \
+    CE(5, 6) CE(9, 10) CE(0, 4) CE(1, 5) CE(2, 6) CE(3, 7) CE(8, 12) \
+    CE(9, 13) CE(2, 4) CE(3, 5) CE(10, 12) CE(11, 13) CE(1, 2) CE(3, 4) \
+    CE(5, 6) CE(9, 10) CE(11, 12) CE(0, 8) CE(1, 9) CE(2, 10) CE(3, 11) \
+    CE(4, 12) CE(5, 13) CE(4, 8) CE(5, 9) CE(6, 10) CE(7, 11) CE(2, 4) \
+    CE(3, 5) CE(6, 8) CE(7, 9) CE(10, 12) CE(11, 13) CE(1, 2) CE(3, 4) \
+    CE(5, 6) CE(7, 8) CE(9, 10) CE(11, 12)
+
+// 15 entradas, 59 comparadores
+#define SORTING_NETWORK_15(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(6, 7) CE(8, 9) CE(10, 11) CE(12, 13) \
+    CE(0, 2) CE(1, 3) CE(4, 6) CE(5, 7) CE(8, 10) CE(9, 11) CE(12, 14) \
+    CE(1, 2) CE(5, 6) CE(9, 10) CE(13, 14) CE(0, 4) CE(1, 5) CE(2, 6) \
+    CE(3, 7) CE(8, 12) CE(9, 13) CE(10, 14) CE(2, 4) CE(3, 5) CE(10, 12) \
+    CE(11, 13) CE(1, 2) CE(3, 4) CE(5, 6) CE(9, 10) CE(11, 12) CE(13, 14) \
+    CE(0, 8) CE(1, 9) CE(2, 10) CE(3, 11) CE(4, 12) CE(5, 13) CE(6, 14) \
+    CE(4, 8) CE(5, 9) CE(6, 10) CE(7, 11) CE(2, 4) CE(3, 5) CE(6, 8) \
+    CE(7, 9) CE(10, 12) CE(11, 13) CE(1, 2) CE(3, 4) CE(5, 6) CE(7, 8) \
+    CE(9, 10) CE(11, 12) CE(13, 14)
+
+// 16 entradas, 63 comparadores
+#define SORTING_NETWORK_16(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(6, 7) CE(8, 9) CE(10, 11) CE(12, 13) \
+    CE(14, 15) CE(0, 2) CE(1, 3) CE(4, 6) CE(5, 7) CE(8, 10) CE(9, 11) \
+    CE(12, 14) CE(13, 15) CE(1, 2) CE(5, 6) CE(9, 10) CE(13, 14) CE(0, 4) \
+    CE(1, 5) CE(2, 6) CE(3, 7) CE(8, 12) CE(9, 13) CE(10, 14) CE(11, 15) \
+    CE(2, 4) CE(3, 5) CE(10, 12) CE(11, 13) CE(1, 2) CE(3, 4) CE(5, 6) \
+    CE(9, 10) CE(11, 12) CE(13, 14) CE(0, 8) CE(1, 9) CE(2, 10) CE(3, 11) \
+    CE(4, 12) CE(5, 13) CE(6, 14) CE(7, 15) CE(4, 8) CE(5, 9) CE(6, 10) \
+    CE(7, 11) CE(2, 4) CE(3, 5) CE(6, 8) CE(7, 9) CE(10, 12) CE(11, 13) \
+    CE(1, 2) CE(3, 4) CE(5, 6) CE(7, 8) CE(9, 10) CE(11, 12) CE(13, 14)
+
+// 32 entradas, 191 comparadores
+#define SORTING_NETWORK_32(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(6, 7) CE(8, 9) CE(10, 11) CE(12, 13) \
+    CE(14, 15) CE(16, 17) CE(18, 19) CE(20, 21) CE(22, 23) CE(24, 25) \
+    CE(26, 27) CE(28, 29) CE(30, 31) CE(0, 2) CE(1, 3) CE(4, 6) CE(5, 7) \
+    CE(8, 10) CE(9, 11) CE(12, 14) CE(13, 15) CE(16, 18) CE(17, 19) \
+    CE(20, 22) CE(21, 23) CE(24, 26) CE(25, 27) CE(28, 30) CE(29, 31) \
+    CE(1, 2) CE(5, 6) CE(9, 10) CE(13, 14) CE(17, 18) CE(21, 22) CE(25, 26) \
+    CE(29, 30) CE(0, 4) CE(1, 5) CE(2, 6) CE(3, 7) CE(8, 12) CE(9, 13) \
+    CE(10, 14) CE(11, 15) CE(16, 20) CE(17, 21) CE(18, 22) CE(19, 23) \
+    CE(24, 28) CE(25, 29) CE(26, 30) CE(27, 31) CE(2, 4) CE(3, 5) CE(10, 12) \
+    CE(11, 13) CE(18, 20) CE(19, 21) CE(26, 28) CE(27, 29) CE(1, 2) CE(3, 4) \
+    CE(5, 6) CE(9, 10) CE(11, 12) CE(13, 14) CE(17, 18) CE(19, 20) \
+    CE(21, 22) CE(25, 26) CE(27, 28) CE(29, 30) CE(0, 8) CE(1, 9) CE(2, 10) \
+    CE(3, 11) CE(4, 12) CE(5, 13) CE(6, 14) CE(7, 15) CE(16, 24) CE(17, 25) \
+    CE(18, 26) CE(19, 27) CE(20, 28) CE(21, 29) CE(22, 30) CE(23, 31) \
+    CE(4, 8) CE(5, 9) CE(6, 10) CE(7, 11) CE(20, 24) CE(21, 25) CE(22, 26) \
+    CE(23, 27) CE(2, 4) CE(3, 5) CE(6, 8) CE(7, 9) CE(10, 12) CE(11, 13) \
+    CE(18, 20) CE(19, 21) CE(22, 24) CE(23, 25) CE(26, 28) CE(27, 29) \
+    CE(1, 2) CE(3, 4) CE(5, 6) CE(7, 8) CE(9, 10) CE(11, 12) CE(13, 14) \
+    CE(17, 18) CE(19, 20) CE(21, 22) CE(23, 24) CE(25, 26) CE(27, 28) \
+    CE(29, 30) CE(0, 16) CE(1, 17) CE(2, 18) CE(3, 19) CE(4, 20) CE(5, 21) \
+    CE(6, 22) CE(7, 23) CE(8, 24) CE(9, 25) CE(10, 26) CE(11, 27) CE(12, 28) \
+    CE(13, 29) CE(14, 30) CE(15, 31) CE(8, 16) CE(9, 17) CE(10, 18) \
+    CE(11, 19) CE(12, 20) CE(13, 21) CE(14, 22) CE(15, 23) CE(4, 8) CE(5, 9) \
+    CE(6, 10) CE(7, 11) CE(12, 16) CE(13, 17) CE(14, 18) CE(15, 19) \
+    CE(20, 24) CE(21, 25) CE(22, 26) CE(23, 27) CE(2, 4) CE(3, 5) CE(6, 8) \
+    CE(7, 9) CE(10, 12) CE(11, 13) CE(14, 16) CE(15, 17) CE(18, 20) \
+    CE(19, 21) CE(22, 24) CE(23, 25) CE(26, 28) CE(27, 29) CE(1, 2) CE(3, 4) \
+    CE(5, 6) CE(7, 8) CE(9, 10) CE(11, 12) CE(13, 14) CE(15, 16) CE(17, 18) \
+    CE(19, 20) CE(21, 22) CE(23, 24) CE(25, 26) CE(27, 28) CE(29, 30)
+
+// 64 entradas, 543 comparadores
+#define SORTING_NETWORK_64(CE) \
+    CE(0, 1) CE(2, 3) CE(4, 5) CE(6, 7) CE(8, 9) CE(10, 11) CE(12, 13) \
+    CE(14, 15) CE(16, 17) CE(18, 19) CE(20, 21) CE(22, 23) CE(24, 25) \
+    CE(26, 27) CE(28, 29) CE(30, 31) CE(32, 33) CE(34, 35) CE(36, 37) \
+    CE(38, 39) CE(40, 41) CE(42, 43) CE(44, 45) CE(46, 47) CE(48, 49) \
+    CE(50, 51) CE(52, 53) CE(54, 55) CE(56, 57) CE(58, 59) CE(60, 61) \
+    CE(62, 63) CE(0, 2) CE(1, 3) CE(4, 6) CE(5, 7) CE(8, 10) CE(9, 11) \
+    CE(12, 14) CE(13, 15) CE(16, 18) CE(17, 19) CE(20, 22) CE(21, 23) \
+    CE(24, 26) CE(25, 27) CE(28, 30) CE(29, 31) CE(32, 34) CE(33, 35) \
+    CE(36, 38) CE(37, 39) CE(40, 42) CE(41, 43) CE(44, 46) CE(45, 47) \
+    CE(48, 50) CE(49, 51) CE(52, 54) CE(53, 55) CE(56, 58) CE(57, 59) \
+    CE(60, 62) CE(61, 63) CE(1, 2) CE(5, 6) CE(9, 10) CE(13, 14) CE(17, 18) \
+    CE(21, 22) CE(25, 26) CE(29, 30) CE(33, 34) CE(37, 38) CE(41, 42) \
+    CE(45, 46) CE(49, 50) CE(53, 54) CE(57, 58) CE(61, 62) CE(0, 4) CE(1, 5) \
+    CE(2, 6) CE(3, 7) CE(8, 12) CE(9, 13) CE(10, 14) CE(11, 15) CE(16, 20) \
+    CE(17, 21) CE(18, 22) CE(19, 23) CE(24, 28) CE(25, 29) CE(26, 30) \
+    CE(27, 31) CE(32, 36) CE(33, 37) CE(34, 38) CE(35, 39) CE(40, 44) \
+    CE(41, 45) CE(42, 46) CE(43, 47) CE(48, 52) CE(49, 53) CE(50, 54) \
+    CE(51, 55) CE(56, 60) CE(57, 61) CE(58, 62) CE(59, 63) CE(2, 4) CE(3, 5) \
+    CE(10, 12) CE(11, 13) CE(18, 20) CE(19, 21) CE(26, 28) CE(27, 29) \
+    CE(34, 36) CE(35, 37) CE(42, 44) CE(43, 45) CE(50, 52) CE(51, 53) \
+    CE(58, 60) CE(59, 61) CE(1, 2) CE(3, 4) CE(5, 6) CE(9, 10) CE(11, 12) \
+    CE(13, 14) CE(17, 18) CE(19, 20) CE(21, 22) CE(25, 26) CE(27, 28) \
+    CE(29, 30) CE(33, 34) CE(35, 36) CE(37, 38) CE(41, 42) CE(43, 44) \
+    CE(45, 46) CE(49, 50) CE(51, 52) CE(53, 54) CE(57, 58) CE(59, 60) \
+    CE(61, 62) CE(0, 8) CE(1, 9) CE(2, 10) CE(3, 11) CE(4, 12) CE(5, 13) \
+    CE(6, 14) CE(7, 15) CE(16, 24) CE(17, 25) CE(18, 26) CE(19, 27) \
+    CE(20, 28) CE(21, 29) CE(22, 30) CE(23, 31) CE(32, 40) CE(33, 41) \
+    CE(34, 42) CE(35, 43) CE(36, 44) CE(37, 45) CE(38, 46) CE(39, 47) \
+    CE(48, 56) CE(49, 57) CE(50, 58) CE(51, 59) CE(52, 60) CE(53, 61) \
+    CE(54, 62) CE(55, 63) CE(4, 8) CE(5, 9) CE(6, 10) CE(7, 11) CE(20, 24) \
+    CE(21, 25) CE(22, 26) CE(23, 27) CE(36, 40) CE(37, 41) CE(38, 42) \
+    CE(39, 43) CE(52, 56) CE(53, 57) CE(54, 58) CE(55, 59) CE(2, 4) CE(3, 5) \
+    CE(6, 8) CE(7, 9) CE(10, 12) CE(11, 13) CE(18, 20) CE(19, 21) CE(22, 24) \
+    CE(23, 25) CE(26, 28) CE(27, 29) CE(34, 36) CE(35, 37) CE(38, 40) \
+    CE(39, 41) CE(42, 44) CE(43, 45) CE(50, 52) CE(51, 53) CE(54, 56) \
+    CE(55, 57) CE(58, 60) CE(59, 61) CE(1, 2) CE(3, 4) CE(5, 6) CE(7, 8) \
+    CE(9, 10) CE(11, 12) CE(13, 14) CE(17, 18) CE(19, 20) CE(21, 22) \
+    CE(23, 24) CE(25, 26) CE(27, 28) CE(29, 30) CE(33, 34) CE(35, 36) \
+    CE(37, 38) CE(39, 40) CE(41, 42) CE(43, 44) CE(45, 46) CE(49, 50) \
+    CE(51, 52) CE(53, 54) CE(55, 56) CE(57, 58) CE(59, 60) CE(61, 62) \
+    CE(0, 16) CE(1, 17) CE(2, 18) CE(3, 19) CE(4, 20) CE(5, 21) CE(6, 22) \
+    CE(7, 23) CE(8, 24) CE(9, 25) CE(10, 26) CE(11, 27) CE(12, 28) \
+    CE(13, 29) CE(14, 30) CE(15, 31) CE(32, 48) CE(33, 49) CE(34, 50) \
+    CE(35, 51) CE(36, 52) CE(37, 53) CE(38, 54) CE(39, 55) CE(40, 56) \
+    CE(41, 57) CE(42, 58) CE(43, 59) CE(44, 60) CE(45, 61) CE(46, 62) \
+    CE(47, 63) CE(8, 16) CE(9, 17) CE(10, 18) CE(11, 19) CE(12, 20) \
+    CE(13, 21) CE(14, 22) CE(15, 23) CE(40, 48) CE(41, 49) CE(42, 50) \
+    CE(43, 51) CE(44, 52) CE(45, 53) CE(46, 54) CE(47, 55) CE(4, 8) CE(5, 9) \
+    CE(6, 10) CE(7, 11) CE(12, 16) CE(13, 17) CE(14, 18) CE(15, 19) \
+    CE(20, 24) CE(21, 25) CE(22, 26) CE(23, 27) CE(36, 40) CE(37, 41) \
+    CE(38, 42) CE(39, 43) CE(44, 48) CE(45, 49) CE(46, 50) CE(47, 51) \
+    CE(52, 56) CE(53, 57) CE(54, 58) CE(55, 59) CE(2, 4) CE(3, 5) CE(6, 8) \
+    CE(7, 9) CE(10, 12) CE(11, 13) CE(14, 16) CE(15, 17) CE(18, 20) \
+    CE(19, 21) CE(22, 24) CE(23, 25) CE(26, 28) CE(27, 29) CE(34, 36) \
+    CE(35, 37) CE(38, 40) CE(39, 41) CE(42, 44) CE(43, 45) CE(46, 48) \
+    CE(47, 49) CE(50, 52) CE(51, 53) CE(54, 56) CE(55, 57) CE(58, 60) \
+    CE(59, 61) CE(1, 2) CE(3, 4) CE(5, 6) CE(7, 8) CE(9, 10) CE(11, 12) \
+    CE(13, 14) CE(15, 16) CE(17, 18) CE(19, 20) CE(21, 22) CE(23, 24) \
+    CE(25, 26) CE(27, 28) CE(29, 30) CE(33, 34) CE(35, 36) CE(37, 38) \
+    CE(39, 40) CE(41, 42) CE(43, 44) CE(45, 46) CE(47, 48) CE(49, 50) \
+    CE(51, 52) CE(53, 54) CE(55, 56) CE(57, 58) CE(59, 60) CE(61, 62) \
+    CE(0, 32) CE(1, 33) CE(2, 34) CE(3, 35) CE(4, 36) CE(5, 37) CE(6, 38) \
+    CE(7, 39) CE(8, 40) CE(9, 41) CE(10, 42) CE(11, 43) CE(12, 44) \
+    CE(13, 45) CE(14, 46) CE(15, 47) CE(16, 48) CE(17, 49) CE(18, 50) \
+    CE(19, 51) CE(20, 52) CE(21, 53) CE(22, 54) CE(23, 55) CE(24, 56) \
+    CE(25, 57) CE(26, 58) CE(27, 59) CE(28, 60) CE(29, 61) CE(30, 62) \
+    CE(31, 63) CE(16, 32) CE(17, 33) CE(18, 34) CE(19, 35) CE(20, 36) \
+    CE(21, 37) CE(22, 38) CE(23, 39) CE(24, 40) CE(25, 41) CE(26, 42) \
+    CE(27, 43) CE(28, 44) CE(29, 45) CE(30, 46) CE(31, 47) CE(8, 16) \
+    CE(9, 17) CE(10, 18) CE(11, 19) CE(12, 20) CE(13, 21) CE(14, 22) \
+    CE(15, 23) CE(24, 32) CE(25, 33) CE(26, 34) CE(27, 35) CE(28, 36) \
+    CE(29, 37) CE(30, 38) CE(31, 39) CE(40, 48) CE(41, 49) CE(42, 50) \
+    CE(43, 51) CE(44, 52) CE(45, 53) CE(46, 54) CE(47, 55) CE(4, 8) CE(5, 9) \
+    CE(6, 10) CE(7, 11) CE(12, 16) CE(13, 17) CE(14, 18) CE(15, 19) \
+    CE(20, 24) CE(21, 25) CE(22, 26) CE(23, 27) CE(28, 32) CE(29, 33) \
+    CE(30, 34) CE(31, 35) CE(36, 40) CE(37, 41) CE(38, 42) CE(39, 43) \
+    CE(44, 48) CE(45, 49) CE(46, 50) CE(47, 51) CE(52, 56) CE(53, 57) \
+    CE(54, 58) CE(55, 59) CE(2, 4) CE(3, 5) CE(6, 8) CE(7, 9) CE(10, 12) \
+    CE(11, 13) CE(14, 16) CE(15, 17) CE(18, 20) CE(19, 21) CE(22, 24) \
+    CE(23, 25) CE(26, 28) CE(27, 29) CE(30, 32) CE(31, 33) CE(34, 36) \
+    CE(35, 37) CE(38, 40) CE(39, 41) CE(42, 44) CE(43, 45) CE(46, 48) \
+    CE(47, 49) CE(50, 52) CE(51, 53) CE(54, 56) CE(55, 57) CE(58, 60) \
+    CE(59, 61) CE(1, 2) CE(3, 4) CE(5, 6) CE(7, 8) CE(9, 10) CE(11, 12) \
+    CE(13, 14) CE(15, 16) CE(17, 18) CE(19, 20) CE(21, 22) CE(23, 24) \
+    CE(25, 26) CE(27, 28) CE(29, 30) CE(31, 32) CE(33, 34) CE(35, 36) \
+    CE(37, 38) CE(39, 40) CE(41, 42) CE(43, 44) CE(45, 46) CE(47, 48) \
+    CE(49, 50) CE(51, 52) CE(53, 54) CE(55, 56) CE(57, 58) CE(59, 60) \
+    CE(61, 62)
+
+// 1 passo
+#define UNROLL_1(STEP) \
+    STEP(0)
+
+// 2 passos
+#define UNROLL_2(STEP) \
+    STEP(0) STEP(1)
+
+// 3 passos
+#define UNROLL_3(STEP) \
+    STEP(0) STEP(1) STEP(2)
+
+// 4 passos
+#define UNROLL_4(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3)
+
+// 5 passos
+#define UNROLL_5(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4)
+
+// 6 passos
+#define UNROLL_6(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5)
+
+// 7 passos
+#define UNROLL_7(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6)
+
+// 8 passos
+#define UNROLL_8(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6) STEP(7)
+
+// 9 passos
+#define UNROLL_9(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6) STEP(7) STEP(8)
+
+// 10 passos
+#define UNROLL_10(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6) STEP(7) STEP(8) \
+    STEP(9)
+
+// 11 passos
+#define UNROLL_11(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6) STEP(7) STEP(8) \
+    STEP(9) STEP(10)
+
+// 12 passos
+#define UNROLL_12(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6) STEP(7) STEP(8) \
+    STEP(9) STEP(10) STEP(11)
+
+// 13 passos
+#define UNROLL_13(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6) STEP(7) STEP(8) \
+    STEP(9) STEP(10) STEP(11) STEP(12)
+
+// 14 passos
+#define UNROLL_14(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6) STEP(7) STEP(8) \
+    STEP(9) STEP(10) STEP(11) STEP(12) STEP(13)
+
+// 15 passos
+#define UNROLL_15(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6) STEP(7) STEP(8) \
+    STEP(9) STEP(10) STEP(11) STEP(12) STEP(13) STEP(14)
+
+// 16 passos
+#define UNROLL_16(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6) STEP(7) STEP(8) \
+    STEP(9) STEP(10) STEP(11) STEP(12) STEP(13) STEP(14) STEP(15)
+
+// 32 passos
+#define UNROLL_32(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6) STEP(7) STEP(8) \
+    STEP(9) STEP(10) STEP(11) STEP(12) STEP(13) STEP(14) STEP(15) STEP(16) \
+    STEP(17) STEP(18) STEP(19) STEP(20) STEP(21) STEP(22) STEP(23) STEP(24) \
+    STEP(25) STEP(26) STEP(27) STEP(28) STEP(29) STEP(30) STEP(31)
+
+// 64 passos
+#define UNROLL_64(STEP) \
+    STEP(0) STEP(1) STEP(2) STEP(3) STEP(4) STEP(5) STEP(6) STEP(7) STEP(8) \
+    STEP(9) STEP(10) STEP(11) STEP(12) STEP(13) STEP(14) STEP(15) STEP(16) \
+    STEP(17) STEP(18) STEP(19) STEP(20) STEP(21) STEP(22) STEP(23) STEP(24) \
+    STEP(25) STEP(26) STEP(27) STEP(28) STEP(29) STEP(30) STEP(31) STEP(32) \
+    STEP(33) STEP(34) STEP(35) STEP(36) STEP(37) STEP(38) STEP(39) STEP(40) \
+    STEP(41) STEP(42) STEP(43) STEP(44) STEP(45) STEP(46) STEP(47) STEP(48) \
+    STEP(49) STEP(50) STEP(51) STEP(52) STEP(53) STEP(54) STEP(55) STEP(56) \
+    STEP(57) STEP(58) STEP(59) STEP(60) STEP(61) STEP(62) STEP(63)
+
+#endif // SORTING_NETWORKS_H
@@ -0,0 +1,200 @@
+#include <stdio.h>
+#include <string.h>
+#include "aggregate.h"
+#include "utils.h"
+
+/*
+ * ============================================================================
+ * MÓDULO DE AGREGAÇÃO - Manutenção Incremental de Totais
+ * ============================================================================
+ * Adição é sempre O(grupos): soma, contagem, mínimo e máximo podem ser
+ * atualizados com o valor novo. Remoção também, exceto quando o valor que
+ * sai é o mínimo ou o máximo do grupo - aí o novo extremo só pode ser
+ * descoberto revarrendo os itens daquele grupo.
+ */
+
+static void quantity_reset(QuantityStats *q) {
+    q->count = 0;
+    q->sum = 0;
+    q->min = 0;
+    q->max = 0;
+}
+
+static void quantity_add(QuantityStats *q, int quantity) {
+    if (q->count == 0 || quantity < q->min) q->min = quantity;
+    if (q->count == 0 || quantity > q->max) q->max = quantity;
+    q->count++;
+    q->sum += quantity;
+}
+
+/**
+ * Retira um valor do grupo
+ * @return 1 se o mínimo/máximo ficou desatualizado e exige revarredura
+ */
+static int quantity_remove(QuantityStats *q, int quantity) {
+    q->count--;
+    q->sum -= quantity;
+
+    if (q->count == 0) {
+        quantity_reset(q);
+        return 0;
+    }
+    return quantity == q->min || quantity == q->max;
+}
+
+// Normaliza tipo para a chave case-insensitive do grupo
+static void type_key(char *key, const char *type) {
+    snprintf(key, ITEM_TYPE_LEN, "%s", type);
+    str_to_upper(key);
+}
+
+static int find_type_group(const InventoryStats *stats, const char *key) {
+    for (int i = 0; i < stats->type_count; i++) {
+        if (strcmp(stats->by_type[i].key, key) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Retorna o grupo do tipo, criando-o se ainda não existir
+static TypeGroup *type_group_for(InventoryStats *stats, const char *type) {
+    char key[ITEM_TYPE_LEN];
+    type_key(key, type);
+
+    int g = find_type_group(stats, key);
+    if (g != -1) return &stats->by_type[g];
+    if (stats->type_count >= INVENTORY_SIZE) return NULL;
+
+    TypeGroup *group = &stats->by_type[stats->type_count++];
+    snprintf(group->type, ITEM_TYPE_LEN, "%s", type);
+    strcpy(group->key, key);
+    quantity_reset(&group->stats);
+    return group;
+}
+
+// Prioridades fora da faixa são contadas como "sem prioridade"
+static int priority_slot(int priority) {
+    return (priority >= 0 && priority <= MAX_PRIORITY) ? priority : 0;
+}
+
+/*
+ * ============================================================================
+ * FUNÇÕES PÚBLICAS - Interface Definida no Header
+ * ============================================================================
+ */
+
+void stats_rebuild(InventoryStats *stats, const Item *inventory, int used) {
+    quantity_reset(&stats->total);
+    for (int p = 0; p <= MAX_PRIORITY; p++) {
+        quantity_reset(&stats->by_priority[p]);
+    }
+    stats->type_count = 0;
+
+    for (int i = 0; i < used; i++) {
+        stats_add_item(stats, &inventory[i]);
+    }
+}
+
+void stats_add_item(InventoryStats *stats, const Item *item) {
+    quantity_add(&stats->total, item->quantity);
+    quantity_add(&stats->by_priority[priority_slot(item->priority)], item->quantity);
+
+    TypeGroup *group = type_group_for(stats, item->type);
+    if (group != NULL) {
+        quantity_add(&group->stats, item->quantity);
+    }
+}
+
+void stats_remove_item(InventoryStats *stats, const Item *inventory, int used,
+                       const Item *removed) {
+    int q = removed->quantity;
+
+    // Total: extremo desatualizado exige varrer todo o inventário
+    if (quantity_remove(&stats->total, q)) {
+        quantity_reset(&stats->total);
+        for (int i = 0; i < used; i++) {
+            quantity_add(&stats->total, inventory[i].quantity);
+        }
+    }
+
+    int slot = priority_slot(removed->priority);
+    QuantityStats *prio = &stats->by_priority[slot];
+    if (quantity_remove(prio, q)) {
+        quantity_reset(prio);
+        for (int i = 0; i < used; i++) {
+            if (priority_slot(inventory[i].priority) == slot) {
+                quantity_add(prio, inventory[i].quantity);
+            }
+        }
+    }
+
+    char key[ITEM_TYPE_LEN];
+    type_key(key, removed->type);
+    int g = find_type_group(stats, key);
+    if (g == -1) return;
+
+    TypeGroup *group = &stats->by_type[g];
+    if (quantity_remove(&group->stats, q)) {
+        quantity_reset(&group->stats);
+        for (int i = 0; i < used; i++) {
+            char item_key[ITEM_TYPE_LEN];
+            type_key(item_key, inventory[i].type);
+            if (strcmp(item_key, key) == 0) {
+                quantity_add(&group->stats, inventory[i].quantity);
+            }
+        }
+    }
+
+    // Grupo vazio: o último ocupa a vaga (ordem dos grupos não importa)
+    if (group->stats.count == 0) {
+        stats->by_type[g] = stats->by_type[--stats->type_count];
+    }
+}
+
+const QuantityStats *stats_by_type(const InventoryStats *stats, const char *type) {
+    char key[ITEM_TYPE_LEN];
+    type_key(key, type);
+
+    int g = find_type_group(stats, key);
+    return (g != -1) ? &stats->by_type[g].stats : NULL;
+}
+
+const QuantityStats *stats_by_priority(const InventoryStats *stats, int priority) {
+    if (priority < 0 || priority > MAX_PRIORITY) return NULL;
+    return &stats->by_priority[priority];
+}
+
+/**
+ * Resumo com formatação adaptativa, no mesmo espírito de list_items():
+ * a tabela por prioridade só aparece se algum item tiver prioridade > 0
+ */
+void print_stats(const InventoryStats *stats) {
+    printf("\n======== RESUMO DE QUANTIDADES (Itens: %d) ========\n", stats->total.count);
+    if (stats->total.count == 0) {
+        printf("Inventário vazio.\n");
+        return;
+    }
+
+    printf("%-12s | %-5s | %-8s | %-6s | %s\n", "Tipo", "Itens", "Total", "Min", "Max");
+    printf("----------------------------------------------------------\n");
+    for (int g = 0; g < stats->type_count; g++) {
+        const TypeGroup *group = &stats->by_type[g];
+        printf("%-12s | %-5d | %-8lld | %-6d | %d\n",
+               group->type, group->stats.count, group->stats.sum,
+               group->stats.min, group->stats.max);
+    }
+
+    if (stats->by_priority[0].count < stats->total.count) {
+        printf("\n%-12s | %-5s | %-8s | %-6s | %s\n", "Prioridade", "Itens", "Total", "Min", "Max");
+        printf("----------------------------------------------------------\n");
+        for (int p = 1; p <= MAX_PRIORITY; p++) {
+            const QuantityStats *q = &stats->by_priority[p];
+            if (q->count == 0) continue;
+            printf("%-12d | %-5d | %-8lld | %-6d | %d\n", p, q->count, q->sum, q->min, q->max);
+        }
+    }
+
+    printf("----------------------------------------------------------\n");
+    printf("Total geral: %lld\n", stats->total.sum);
+}
@@ -13,13 +13,114 @@
  * Não precisam estar no .h pois são detalhes de implementação.
  */
 
+/**
+ * Comparação entre dois itens segundo o critério escolhido
+ * Centraliza a estratégia usada pela ordenação e pelas consultas parciais
+ *
+ * @return < 0 se a vem antes de b, > 0 se vem depois, 0 se empatam
+ */
+static int compare_items(const Item *a, const Item *b, SortCriterion crit) {
+    if (crit == SORT_NAME) return strcmp(a->name, b->name);
+    if (crit == SORT_TYPE) return strcmp(a->type, b->type);
+    if (crit == SORT_PRIORITY) return a->priority - b->priority;
+    return 0;  // SORT_NONE: todos empatam, vale a ordem armazenada
+}
+
+/**
+ * Compara itens pelas posições no array, desempatando pelo índice
+ * O desempate reproduz a estabilidade do Insertion Sort: as consultas
+ * parciais devolvem exatamente o que sort_inventory() produziria.
+ */
+static int compare_indices(const Item *inventory, int a, int b, SortCriterion crit) {
+    int cmp = compare_items(&inventory[a], &inventory[b], crit);
+    if (cmp != 0) return cmp;
+    return a - b;
+}
+
+static void swap_indices(int *idx, int a, int b) {
+    int tmp = idx[a];
+    idx[a] = idx[b];
+    idx[b] = tmp;
+}
+
+/**
+ * Desce o elemento da raiz até restaurar a propriedade de max-heap
+ * O heap guarda índices do inventário, nunca cópias dos itens.
+ */
+static void sift_down(const Item *inventory, SortCriterion crit, int *heap, int size, int root) {
+    while (1) {
+        int largest = root;
+        int left = 2 * root + 1;
+        int right = left + 1;
+
+        if (left < size && compare_indices(inventory, heap[left], heap[largest], crit) > 0)
+            largest = left;
+        if (right < size && compare_indices(inventory, heap[right], heap[largest], crit) > 0)
+            largest = right;
+        if (largest == root) return;
+
+        swap_indices(heap, root, largest);
+        root = largest;
+    }
+}
+
+static void build_heap(const Item *inventory, SortCriterion crit, int *heap, int size) {
+    for (int i = size / 2 - 1; i >= 0; i--) {
+        sift_down(inventory, crit, heap, size, i);
+    }
+}
+
+/**
+ * Fase de extração do Heap Sort: transforma o max-heap em ordem crescente
+ * Complexidade: O(k log k)
+ */
+static void heap_extract_all(const Item *inventory, SortCriterion crit, int *heap, int size) {
+    for (int end = size - 1; end > 0; end--) {
+        swap_indices(heap, 0, end);
+        sift_down(inventory, crit, heap, end, 0);
+    }
+}
+
+/**
+ * Particionamento de Lomuto com pivô pela mediana de três
+ * A mediana evita o pior caso O(n²) em entradas já ordenadas.
+ *
+ * @return Posição final do pivô dentro de [lo, hi]
+ */
+static int partition_indices(const Item *inventory, SortCriterion crit, int *idx, int lo, int hi) {
+    int mid = lo + (hi - lo) / 2;
+
+    // Ordena idx[lo], idx[mid], idx[hi] e usa o do meio como pivô
+    if (compare_indices(inventory, idx[mid], idx[lo], crit) < 0) swap_indices(idx, mid, lo);
+    if (compare_indices(inventory, idx[hi], idx[lo], crit) < 0) swap_indices(idx, hi, lo);
+    if (compare_indices(inventory, idx[hi], idx[mid], crit) < 0) swap_indices(idx, hi, mid);
+    swap_indices(idx, mid, hi);
+
+    int pivot = idx[hi];
+    int store = lo;
+    for (int i = lo; i < hi; i++) {
+        if (compare_indices(inventory, idx[i], pivot, crit) < 0) {
+            swap_indices(idx, i, store);
+            store++;
+        }
+    }
+    swap_indices(idx, store, hi);
+    return store;
+}
+
+/*
+ * ============================================================================
+ * FUNÇÕES PÚBLICAS - Interface Definida no Header
+ * ============================================================================
+ */
+
 /**
  * Busca linear case-insensitive pelo nome do item
  * Complexidade: O(n) onde n = número de itens no inventário
  *
  * @return Índice do item encontrado ou -1 se não existir
  */
-static int find_item_by_name_index(const Item *inventory, int used, const char *name) {
+int find_item_index(const Item *inventory, int used, const char *name) {
     // Normalização: converte busca para uppercase para comparação case-insensitive
     char name_upper[ITEM_NAME_LEN];
     strncpy(name_upper, name, ITEM_NAME_LEN-1);
@@ -40,12 +141,6 @@ static int find_item_by_name_index(const Item *inventory, int used, const char *
     return -1;
 }
 
-/*
- * ============================================================================
- * FUNÇÕES PÚBLICAS - Interface Definida no Header
- * ============================================================================
- */
-
 /**
  * Adiciona item ao inventário com validação em múltiplas camadas
  * A validação é progressiva: capacidade -> formato -> valores
@@ -89,9 +184,9 @@ int add_item(Item *inventory, int *used, int level) {
 
     // Campo prioridade disponível apenas no nível Mestre
     if (level == 3) {
-        printf("Prioridade (1-5): ");
+        printf("Prioridade (1-%d): ", MAX_PRIORITY);
         int pr = read_int_safe();
-        if (pr < 1 || pr > 5) {
+        if (pr < 1 || pr > MAX_PRIORITY) {
             printf("Prioridade inválida, definindo como 1.\n");
             pr = 1;
         }
@@ -141,7 +236,7 @@ void list_items(const Item *inventory, int used) {
  * Remove item por nome e reorganiza o array
  * Utiliza realocação por deslocamento - O(n) no pior caso
  */
-int remove_item_by_name(Item *inventory, int *used) {
+int remove_item_by_name(Item *inventory, int *used, Item *removed) {
     if (*used == 0) {
         printf("Inventário vazio, nada para remover.\n");
         return 0;
@@ -151,12 +246,15 @@ int remove_item_by_name(Item *inventory, int *used) {
     printf("Digite o NOME do item a remover: ");
     read_str_safe(name_to_remove, ITEM_NAME_LEN);
 
-    int index = find_item_by_name_index(inventory, *used, name_to_remove);
+    int index = find_item_index(inventory, *used, name_to_remove);
     if (index == -1) {
         printf("Item '%s' não encontrado.\n", name_to_remove);
         return 0;
     }
 
+    // Cópia antes do deslocamento, para quem precisa saber o que saiu
+    if (removed != NULL) *removed = inventory[index];
+
     // Realocação: desloca elementos para preencher o espaço
     for (int i = index; i < *used - 1; i++) {
         inventory[i] = inventory[i + 1];
@@ -172,7 +270,7 @@ int remove_item_by_name(Item *inventory, int *used) {
  * Adequada para arrays não ordenados
  */
 void search_item_by_name(const Item *inventory, int used, const char *name) {
-    int index = find_item_by_name_index(inventory, used, name);
+    int index = find_item_index(inventory, used, name);
 
     if (index != -1) {
         const Item *item = &inventory[index];
@@ -190,8 +288,9 @@ void search_item_by_name(const Item *inventory, int used, const char *name) {
  * Vantagens: estável, in-place, eficiente para dados quase ordenados
  *
  * @param crit Critério de ordenação (nome, tipo ou prioridade)
+ * @return Número de comparações realizadas
  */
-void sort_inventory(Item *inventory, int used, SortCriterion crit) {
+int sort_items(Item *inventory, int used, SortCriterion crit) {
     int comparisons = 0;
 
     // Insertion Sort: insere cada elemento na posição correta do subarray ordenado
@@ -200,13 +299,10 @@ void sort_inventory(Item *inventory, int used, SortCriterion crit) {
         int j = i - 1;
 
         while (j >= 0) {
-            int cmp = 0;
             comparisons++;
 
             // Estratégia de comparação baseada no critério
-            if (crit == SORT_NAME) cmp = strcmp(inventory[j].name, temp.name);
-            else if (crit == SORT_TYPE) cmp = strcmp(inventory[j].type, temp.type);
-            else if (crit == SORT_PRIORITY) cmp = inventory[j].priority - temp.priority;
+            int cmp = compare_items(&inventory[j], &temp, crit);
 
             if (cmp > 0) {
                 inventory[j + 1] = inventory[j];
@@ -218,6 +314,14 @@ void sort_inventory(Item *inventory, int used, SortCriterion crit) {
         inventory[j + 1] = temp;
     }
 
+    return comparisons;
+}
+
+/**
+ * Ordena e informa o custo da ordenação ao usuário
+ */
+void sort_inventory(Item *inventory, int used, SortCriterion crit) {
+    int comparisons = sort_items(inventory, used, crit);
     printf("Inventário ordenado! Comparações realizadas: %d\n", comparisons);
 }
 
@@ -268,3 +372,70 @@ int binary_search_by_name(const Item *inventory, int used, const char *name) {
     printf("\nBusca binária: Item '%s' não encontrado. Comparações: %d\n", name, comparisons);
     return -1;
 }
+
+/**
+ * Top-k com heap limitado - O(n log k)
+ *
+ * Mantém um max-heap com os k melhores índices vistos até agora: cada novo
+ * item só entra se vier antes da raiz (o pior dos k). Ao final, a fase de
+ * extração do Heap Sort deixa os índices em ordem crescente.
+ *
+ * O inventário não é permutado, então o critério rastreado em main()
+ * (ex.: SORT_NAME para a busca binária) continua válido.
+ */
+int top_k_items(const Item *inventory, int used, SortCriterion crit, int k, int *out_indices) {
+    if (k > used) k = used;
+    if (k <= 0) return 0;
+
+    for (int i = 0; i < k; i++) {
+        out_indices[i] = i;
+    }
+    build_heap(inventory, crit, out_indices, k);
+
+    for (int i = k; i < used; i++) {
+        if (compare_indices(inventory, i, out_indices[0], crit) < 0) {
+            out_indices[0] = i;
+            sift_down(inventory, crit, out_indices, k, 0);
+        }
+    }
+
+    heap_extract_all(inventory, crit, out_indices, k);
+    return k;
+}
+
+/**
+ * Introselect - O(n) no caso médio, O(n log n) no pior caso
+ *
+ * Quickselect sobre um vetor auxiliar de índices: a cada partição descarta
+ * o lado que não contém a posição n. Se a recursão ficar profunda demais
+ * (pivôs ruins em sequência), cai para Heap Sort no intervalo restante,
+ * garantindo o limite de pior caso.
+ */
+int nth_item_index(const Item *inventory, int used, SortCriterion crit, int n) {
+    if (n < 0 || n >= used) return -1;
+
+    int idx[used];  // VLA (C99): só índices, o inventário fica intacto
+    for (int i = 0; i < used; i++) {
+        idx[i] = i;
+    }
+
+    // Limite de profundidade: 2 * floor(log2(used))
+    int depth_limit = 0;
+    for (int m = used; m > 1; m >>= 1) depth_limit += 2;
+
+    int lo = 0, hi = used - 1;
+    while (lo < hi) {
+        if (depth_limit-- == 0) {
+            build_heap(inventory, crit, idx + lo, hi - lo + 1);
+            heap_extract_all(inventory, crit, idx + lo, hi - lo + 1);
+            return idx[n];
+        }
+
+        int p = partition_indices(inventory, crit, idx, lo, hi);
+        if (n == p) return idx[p];
+        if (n < p) hi = p - 1;
+        else lo = p + 1;
+    }
+
+    return idx[lo];
+}
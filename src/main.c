@@ -3,6 +3,7 @@
 #include <locale.h>
 
 #include "inventory.h"
+#include "aggregate.h"
 #include "utils.h"
 
 /*
@@ -36,21 +37,29 @@ static void show_main_menu(int level) {
     if (level == 3) {
         printf("6. Ordenar inventário\n");
         printf("7. Buscar item (binária)\n");
+        printf("8. Top-k por critério (sem reordenar)\n");
+        printf("9. N-ésimo por critério (sem reordenar)\n");
     }
+    if (level >= 2) printf("10. Resumo de quantidades (tipo/prioridade)\n");
     printf("0. Sair\nOpção: ");
 }
 
-// Gerencia estado da ordenação após adição de item
-static void handle_add_item(Item *inv, int *used, int level, SortCriterion *sorted) {
+// Gerencia estado da ordenação e dos agregados após adição de item
+static void handle_add_item(Item *inv, int *used, int level, SortCriterion *sorted,
+                            InventoryStats *stats) {
     if (add_item(inv, used, level)) {
         *sorted = SORT_NONE;  // Adicionar novo item invalida a ordenação existente
+        stats_add_item(stats, &inv[*used - 1]);
     }
 }
 
-// Gerencia estado da ordenação após remoção de item
-static void handle_remove_item(Item *inv, int *used, SortCriterion *sorted) {
-    if (remove_item_by_name(inv, used)) {
+// Gerencia estado da ordenação e dos agregados após remoção de item
+static void handle_remove_item(Item *inv, int *used, SortCriterion *sorted,
+                               InventoryStats *stats) {
+    Item removed;
+    if (remove_item_by_name(inv, used, &removed)) {
         *sorted = SORT_NONE;  // Remover item invalida a ordenação existente
+        stats_remove_item(stats, inv, *used, &removed);
     }
 }
 
@@ -62,20 +71,70 @@ static void handle_search_seq(Item *inv, int used) {
     search_item_by_name(inv, used, search_name);
 }
 
-// Atualiza o critério de ordenação atual do inventário
-static void handle_sort_menu(Item *inv, int used, SortCriterion *sorted) {
+// Lê critério de ordenação; SORT_NONE indica entrada inválida
+static SortCriterion read_sort_criterion() {
     printf("Informe critério: 1=Nome, 2=Tipo, 3=Prioridade: ");
     int crit_int = read_int_safe();
 
-    if (crit_int >= 1 && crit_int <= 3) {
-        SortCriterion crit = (SortCriterion)crit_int;
+    if (crit_int >= 1 && crit_int <= 3) return (SortCriterion)crit_int;
+
+    printf("Critério inválido!\n");
+    return SORT_NONE;
+}
+
+// Atualiza o critério de ordenação atual do inventário
+static void handle_sort_menu(Item *inv, int used, SortCriterion *sorted) {
+    SortCriterion crit = read_sort_criterion();
+
+    if (crit != SORT_NONE) {
         sort_inventory(inv, used, crit);
         *sorted = crit;  // Mantém rastreamento do estado de ordenação
-    } else {
-        printf("Critério inválido!\n");
     }
 }
 
+// Top-k sem permutar o array - *sorted permanece válido
+static void handle_top_k(const Item *inv, int used) {
+    SortCriterion crit = read_sort_criterion();
+    if (crit == SORT_NONE) return;
+
+    printf("Quantos itens (k)? ");
+    int k = read_int_safe();
+
+    int top[INVENTORY_SIZE];
+    int count = top_k_items(inv, used, crit, k, top);
+    if (count == 0) {
+        printf("Nenhum item para exibir.\n");
+        return;
+    }
+
+    printf("\n--- Top %d ---\n", count);
+    for (int i = 0; i < count; i++) {
+        const Item *item = &inv[top[i]];
+        printf("%d. ID %d | Nome: %s | Tipo: %s | Qtde: %d | Prioridade: %d\n",
+               i + 1, top[i] + 1, item->name, item->type, item->quantity, item->priority);
+    }
+}
+
+// N-ésimo elemento sem permutar o array - *sorted permanece válido
+static void handle_nth_item(const Item *inv, int used) {
+    SortCriterion crit = read_sort_criterion();
+    if (crit == SORT_NONE) return;
+
+    printf("Posição desejada (1-%d): ", used);
+    int pos = read_int_safe();
+
+    int index = nth_item_index(inv, used, crit, pos - 1);
+    if (index == -1) {
+        printf("Posição inválida!\n");
+        return;
+    }
+
+    const Item *item = &inv[index];
+    printf("\n%dº na ordem: ID %d\n", pos, index + 1);
+    printf("Nome: %s | Tipo: %s | Qtde: %d | Prioridade: %d\n",
+           item->name, item->type, item->quantity, item->priority);
+}
+
 // Busca binária O(log n) - requer ordenação prévia por nome
 static void handle_binary_search(Item *inv, int used, SortCriterion sorted) {
     // Pré-condição: array deve estar ordenado por nome
@@ -103,6 +162,8 @@ int main() {
     Item inventory[INVENTORY_SIZE];
     int used = 0;
     SortCriterion sortedCriterion = SORT_NONE;  // Rastreamento de ordenação
+    InventoryStats stats;                       // Agregados incrementais
+    stats_rebuild(&stats, inventory, used);
     int running = 1;
     int level = get_challenge_level();
 
@@ -113,13 +174,13 @@ int main() {
 
         switch (opt) {
             case 1:
-                handle_add_item(inventory, &used, level, &sortedCriterion);
+                handle_add_item(inventory, &used, level, &sortedCriterion, &stats);
                 break;
             case 2:
                 list_items(inventory, used);
                 break;
             case 3:
-                handle_remove_item(inventory, &used, &sortedCriterion);
+                handle_remove_item(inventory, &used, &sortedCriterion, &stats);
                 break;
             case 4:
                 // Controle de acesso por nível
@@ -138,6 +199,18 @@ int main() {
                 if (level == 3) handle_binary_search(inventory, used, sortedCriterion);
                 else printf("Opção inválida para este nível.\n");
                 break;
+            case 8:
+                if (level == 3) handle_top_k(inventory, used);
+                else printf("Opção inválida para este nível.\n");
+                break;
+            case 9:
+                if (level == 3) handle_nth_item(inventory, used);
+                else printf("Opção inválida para este nível.\n");
+                break;
+            case 10:
+                if (level >= 2) print_stats(&stats);
+                else printf("Opção inválida para este nível.\n");
+                break;
             case 0:
                 running = 0;
                 printf("Saindo... Até a próxima!\n");
@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * ============================================================================
+ * GERADOR DE include/sorting_networks.h
+ * ============================================================================
+ * Gera as redes de Batcher (odd-even mergesort) para os tamanhos em
+ * NETWORK_SIZES e verifica cada uma pelo princípio 0-1 antes de emitir o
+ * header: uma rede de compara-e-troca ordena qualquer entrada se ordena
+ * todas as sequências de 0s e 1s. Para os mesmos tamanhos emite também
+ * UNROLL_<n>(STEP), usado nas buscas desenroladas.
+ *
+ * Uso (a partir da raiz do projeto):
+ *     gcc -O2 -Wall -Wextra -std=c99 tools/gen_sorting_networks.c -o build/gen_networks
+ *     ./build/gen_networks > build/sorting_networks.h \
+ *         && mv build/sorting_networks.h include/sorting_networks.h
+ *
+ * Para suportar nova capacidade (até MAX_NETWORK_INPUTS), acrescente-a em
+ * NETWORK_SIZES e regenere. Se alguma rede falhar na verificação, nada sai
+ * em stdout e o retorno é 1 - o arquivo intermediário evita sobrescrever o
+ * header com conteúdo vazio.
+ */
+
+#define MAX_NETWORK_INPUTS 64
+#define MAX_COMPARATORS 1024
+#define EXHAUSTIVE_LIMIT 16      // até aqui testa todas as 2^n entradas 0-1
+#define SAMPLED_INPUTS 200000    // acima, amostra aleatória de entradas 0-1
+#define LINE_WIDTH 76
+
+static const int NETWORK_SIZES[] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 32, 64
+};
+
+typedef struct {
+    int a;
+    int b;
+} Comparator;
+
+/**
+ * Pares da rede de Batcher para n arbitrário (mesmo laço do header)
+ * @return Número de comparadores gerados
+ */
+static int build_network(int n, Comparator *out) {
+    int count = 0;
+
+    for (int p = 1; p < n; p += p)
+        for (int k = p; k > 0; k /= 2)
+            for (int j = k % p; j + k < n; j += 2 * k)
+                for (int i = 0; i < k && i + j + k < n; i++)
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                        out[count].a = i + j;
+                        out[count].b = i + j + k;
+                        count++;
+                    }
+
+    return count;
+}
+
+// Aplica a rede a uma entrada 0-1 (bit i = posição i) e testa se ficou ordenada
+static int sorts_bits(const Comparator *net, int count, int n, unsigned long long bits) {
+    char v[MAX_NETWORK_INPUTS];
+    for (int i = 0; i < n; i++) v[i] = (bits >> i) & 1u;
+
+    for (int c = 0; c < count; c++) {
+        if (v[net[c].a] > v[net[c].b]) {
+            v[net[c].a] = 0;
+            v[net[c].b] = 1;
+        }
+    }
+
+    for (int i = 1; i < n; i++) {
+        if (v[i - 1] > v[i]) return 0;
+    }
+    return 1;
+}
+
+static unsigned long long random_bits() {
+    unsigned long long bits = 0;
+    for (int i = 0; i < 4; i++) bits = (bits << 16) ^ (unsigned)(rand() & 0xFFFF);
+    return bits;
+}
+
+/**
+ * Princípio 0-1: exaustivo até EXHAUSTIVE_LIMIT entradas, amostral acima
+ * @return 1 se a rede ordenou todas as entradas testadas
+ */
+static int verify_network(const Comparator *net, int count, int n) {
+    if (n <= EXHAUSTIVE_LIMIT) {
+        for (unsigned long long bits = 0; bits < (1ull << n); bits++) {
+            if (!sorts_bits(net, count, n, bits)) return 0;
+        }
+        return 1;
+    }
+
+    for (int s = 0; s < SAMPLED_INPUTS; s++) {
+        if (!sorts_bits(net, count, n, random_bits())) return 0;
+    }
+    return 1;
+}
+
+static void print_preamble(int sizes) {
+    printf("#ifndef SORTING_NETWORKS_H\n");
+    printf("#define SORTING_NETWORKS_H\n\n");
+    printf("/*\n");
+    printf(" * ============================================================================\n");
+    printf(" * REDES DE ORDENAÇÃO - Sequências Fixas de Compara-e-Troca\n");
+    printf(" * ============================================================================\n");
+    printf(" * SORTING_NETWORK_<n>(CE) expande para a sequência de CE(i, j) da rede de\n");
+    printf(" * Batcher (odd-even mergesort) com n entradas. Cada CE deve deixar o menor\n");
+    printf(" * valor na posição i e o maior na j. Por ser código linear, sem laços nem\n");
+    printf(" * desvios dependentes dos dados, o compilador gera tudo desenrolado.\n");
+    printf(" *\n");
+    printf(" * UNROLL_<n>(STEP) expande para STEP(0) STEP(1) ... STEP(n-1): laço de n\n");
+    printf(" * iterações escrito por extenso, para buscas de capacidade fixa.\n");
+    printf(" *\n");
+    printf(" * ARQUIVO GERADO por tools/gen_sorting_networks.c - não editar à mão.\n");
+    printf(" * Para regenerar (ou incluir novo tamanho em NETWORK_SIZES):\n");
+    printf(" *\n");
+    printf(" *     gcc -O2 -Wall -Wextra -std=c99 tools/gen_sorting_networks.c -o build/gen_networks\n");
+    printf(" *     ./build/gen_networks > build/sorting_networks.h \\\n");
+    printf(" *         && mv build/sorting_networks.h include/sorting_networks.h\n");
+    printf(" *\n");
+    printf(" * O gerador verifica cada rede pelo princípio 0-1 (exaustivo até 16\n");
+    printf(" * entradas, amostral acima) antes de emitir o header.\n");
+    printf(" *\n");
+    // Lista derivada de NETWORK_SIZES, para não desatualizar ao incluir tamanhos
+    printf(" * Redes disponíveis (entradas):");
+    for (int s = 0; s < sizes; s++) {
+        printf("%s %d", s == 0 ? "" : ",", NETWORK_SIZES[s]);
+    }
+    printf(".\n");
+    printf(" */\n");
+}
+
+// Emite tokens separados por espaço, quebrando linhas de até LINE_WIDTH colunas
+static void print_wrapped(const char *tokens[], int count) {
+    char line[LINE_WIDTH + 16] = "   ";
+    for (int c = 0; c < count; c++) {
+        if (strlen(line) + 1 + strlen(tokens[c]) > LINE_WIDTH) {
+            printf("%s \\\n", line);
+            strcpy(line, "   ");
+        }
+        strcat(line, " ");
+        strcat(line, tokens[c]);
+    }
+    printf("%s\n", line);
+}
+
+static void print_network(int n, const Comparator *net, int count) {
+    printf("\n");
+    if (count == 0) {
+        printf("// %d entrada, nenhum comparador\n", n);
+        printf("#define SORTING_NETWORK_%d(CE)\n", n);
+        return;
+    }
+
+    printf("// %d entradas, %d %s\n", n, count, count == 1 ? "comparador" : "comparadores");
+    printf("#define SORTING_NETWORK_%d(CE) \\\n", n);
+
+    char storage[MAX_COMPARATORS][32];
+    const char *tokens[MAX_COMPARATORS];
+    for (int c = 0; c < count; c++) {
+        snprintf(storage[c], sizeof(storage[c]), "CE(%d, %d)", net[c].a, net[c].b);
+        tokens[c] = storage[c];
+    }
+    print_wrapped(tokens, count);
+}
+
+static void print_unroll(int n) {
+    char storage[MAX_NETWORK_INPUTS][16];
+    const char *tokens[MAX_NETWORK_INPUTS];
+    for (int i = 0; i < n; i++) {
+        snprintf(storage[i], sizeof(storage[i]), "STEP(%d)", i);
+        tokens[i] = storage[i];
+    }
+
+    printf("\n// %d %s\n", n, n == 1 ? "passo" : "passos");
+    printf("#define UNROLL_%d(STEP) \\\n", n);
+    print_wrapped(tokens, n);
+}
+
+int main() {
+    Comparator net[MAX_COMPARATORS];
+    int sizes = (int)(sizeof(NETWORK_SIZES) / sizeof(NETWORK_SIZES[0]));
+    srand(1);
+
+    // Verifica tudo antes de escrever, para não deixar header pela metade
+    for (int s = 0; s < sizes; s++) {
+        int n = NETWORK_SIZES[s];
+        if (n < 1 || n > MAX_NETWORK_INPUTS) {
+            fprintf(stderr, "[ERRO] Tamanho %d fora de 1..%d\n", n, MAX_NETWORK_INPUTS);
+            return 1;
+        }
+        int count = build_network(n, net);
+        if (!verify_network(net, count, n)) {
+            fprintf(stderr, "[ERRO] Rede de %d entradas falhou no princípio 0-1\n", n);
+            return 1;
+        }
+    }
+
+    print_preamble(sizes);
+    for (int s = 0; s < sizes; s++) {
+        int n = NETWORK_SIZES[s];
+        int count = build_network(n, net);
+        print_network(n, net, count);
+    }
+    for (int s = 0; s < sizes; s++) {
+        print_unroll(NETWORK_SIZES[s]);
+    }
+    printf("\n#endif // SORTING_NETWORKS_H\n");
+
+    return 0;
+}